@@ -0,0 +1,48 @@
+#!/bin/sh
+# checkvm.sh : runs every program in samples/ and classlib/ once with the
+# tree-walking interpreter and once with -bytecode, and reports any whose
+# output differs.  From the top of the source tree:
+#     sh samples/checkvm.sh [./epsilon]
+# The include lines in these files name the old DOS directory, so they
+# are run from copies (in $TMPDIR) whose includes point at the copies.
+# Exits with 1 if any output differed.  (cows.eps is left out: it's
+# a game, and waits for a player.)
+
+EPSILON=${1:-./epsilon}
+case $EPSILON in /*) ;; *) EPSILON=`pwd`/$EPSILON ;; esac
+TOP=`dirname $0`/..
+WORK=${TMPDIR:-/tmp}/checkvm.$$
+mkdir -p $WORK/classlib || exit 2
+cp $TOP/classlib/*.sgt $WORK/classlib
+cp $TOP/samples/*.sgt $TOP/samples/*.eps $WORK
+trap 'rm -rf $WORK' 0
+
+# Strip the DOS end-of-file marks, and point the includes at the copies
+for f in $WORK/*.sgt $WORK/*.eps $WORK/classlib/*.sgt
+do
+  tr -d '\032' < $f | sed \
+      -e 's#\\\\bc\\\\projec~2\\\\epsilon\\\\src\\\\\([a-z]*\)\.eps#'$WORK'/classlib/\1.sgt#' \
+      -e 's#/home/bmajoros/SgmlTalk/classlib/#'$WORK'/classlib/#' \
+      > $WORK/tmp && mv $WORK/tmp $f
+done
+
+cd $WORK
+STATUS=0
+for f in *.sgt *.eps classlib/*.sgt
+do
+  case $f in
+    cows.eps) continue ;;
+    testargs.eps) ARGS="a b c" ;;
+    benchio.sgt) ARGS="$f lines" ;;
+    *) ARGS= ;;
+  esac
+  $EPSILON $f $ARGS < /dev/null > out.tree 2>&1
+  rm -f *.img classlib/*.img
+  $EPSILON -bytecode $f $ARGS < /dev/null > out.vm 2>&1
+  if cmp -s out.tree out.vm
+  then echo "same  $f (`wc -l < out.tree` lines)"
+  else echo "DIFF  $f"; diff out.tree out.vm | head -10; STATUS=1
+  fi
+  rm -f *.img classlib/*.img
+done
+exit $STATUS
@@ -0,0 +1,39 @@
+#!/bin/sh
+# gcstats.sh : runs testdict.sgt, testgraf.sgt and benchgc.sgt with
+# -gcstats, so the collector's report follows each one's output.  The
+# two small tests are run again with a tiny nursery and old generation,
+# so that they see full collections as well.  From the top of the
+# source tree:
+#     sh samples/gcstats.sh [./epsilon]
+# As in checkvm.sh, they're run from copies whose includes point at the
+# copies.
+
+EPSILON=${1:-./epsilon}
+case $EPSILON in /*) ;; *) EPSILON=`pwd`/$EPSILON ;; esac
+TOP=`dirname $0`/..
+WORK=${TMPDIR:-/tmp}/gcstats.$$
+mkdir -p $WORK/classlib || exit 2
+cp $TOP/classlib/*.sgt $WORK/classlib
+cp $TOP/samples/testdict.sgt $TOP/samples/testgraf.sgt \
+   $TOP/samples/benchgc.sgt $WORK
+trap 'rm -rf $WORK' 0
+
+for f in $WORK/*.sgt $WORK/classlib/*.sgt
+do
+  tr -d '\032' < $f | sed \
+      -e 's#\\\\bc\\\\projec~2\\\\epsilon\\\\src\\\\\([a-z]*\)\.eps#'$WORK'/classlib/\1.sgt#' \
+      > $WORK/tmp && mv $WORK/tmp $f
+done
+
+cd $WORK
+for OPTS in "-gcstats" "-gcstats -nursery=100 -oldthreshold=200"
+do
+  for f in testdict.sgt testgraf.sgt
+  do
+    echo "== epsilon $OPTS $f"
+    $EPSILON $OPTS $f 2>&1
+    rm -f *.img
+  done
+done
+echo "== epsilon -gcstats benchgc.sgt"
+$EPSILON -gcstats benchgc.sgt 2>&1